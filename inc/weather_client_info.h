@@ -65,6 +65,11 @@ public:
     /// \param api_key The server requires an API key. It can be given here.
     /// \return A string which in this case is your HTTPS request.
     [[nodiscard]] std::string generate_http_weather_request(const std::string& host_name, const std::string& url_path, const std::string& api_key) const;
+
+    /// This method generates the header that shows for which location the weather is displayed, e.g. 'WEATHER FOR: NL, Enschede'.
+    /// \param header_title The title of the header. This could be 'WEATHER' or 'FORECAST'.
+    /// \return A string which in this case is your header, without a new line.
+    [[nodiscard]] std::string generate_location_header(const std::string& header_title) const;
 private:
     std::pair<boost::any, std::string> m_temperature_exists; // A field if your temperature exists (will be written to the standard out after retrieving the data via de webserver).
     std::pair<boost::any, std::string> m_min_temp_exists; // A field if your minimum temperature exists (will be written to the standard out after retrieving the data via de webserver).
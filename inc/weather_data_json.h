@@ -6,10 +6,13 @@
 #include <boost/beast.hpp> // Include the 'Boost' facilities, in this case 'beast'.
 
 #include <iostream> // Include the 'standard' facilities, in this case 'iostream'.
+#include <stdexcept> // Include the 'standard' facilities, in this case 'stdexcept'.
 
 #include "weather_client_info.h" // Include the 'weather_json_parser' facilities.
+#include "weather_forecast_parser.h" // Include the 'weather_forecast_parser' facilities.
 
 #define PORT_VALUE_HTTPS (443) // Define of the port used for HTTPS.
+#define FORECAST_CHUNK_SIZE (4096) // Define of the size of a single chunk of the body, that is read from the socket at once.
 
 /// This is the 'weather_data_json' class. This class is given this name because it really only serves the purpose of returning a JSON message from the web server that supplies it.
 /// It contacts the server by performing a handshake, and then actually gets the data in the form of a JSON format.
@@ -26,7 +29,16 @@ public:
     /// \return A string with the whole JSON object with weather data.
     [[nodiscard]] std::string retrieve_weather_json() const;
 
+    /// This method contacts the webserver just like 'retrieve_weather_json', but it never buffers the whole body. Every chunk of the body is directly fed to the forecast parser when it arrives from the socket.
+    /// \param forecast_parser The parser that receives all chunks of the JSON body, and stores the forecast entries.
+    /// \return True if the whole forecast is retrieved and parsed, false otherwise.
+    [[nodiscard]] bool stream_weather_forecast(weather_forecast_parser& forecast_parser) const;
+
 private:
+    /// This method connects with the webserver, applies the handshake, and sends the HTTPS request to it. The response can then be read from the given socket.
+    /// \param socket_application The SSL socket used for the connection with the webserver.
+    void send_weather_request(boost::asio::ssl::stream<boost::asio::ip::tcp::socket>& socket_application) const;
+
     weather_client_info m_client_data; // This field contains the data of your client.
 
     std::string m_host_name_weather_app; // This field represents the hostname of the weather app. In this case 'openweathermap'.
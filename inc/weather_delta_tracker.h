@@ -0,0 +1,57 @@
+#ifndef WEATHER_APP_WEATHER_DELTA_TRACKER_H
+#define WEATHER_APP_WEATHER_DELTA_TRACKER_H
+
+#include <array> // Include the 'standard' facilities, in this case 'array'.
+#include <cstdint> // Include the 'standard' facilities, in this case 'cstdint'.
+#include <map> // Include the 'standard' facilities, in this case 'map'.
+#include <string> // Include the 'standard' facilities, in this case 'string'.
+
+#include "weather_client_info.h" // Include the 'weather_client_info' facilities.
+
+#define DELTA_FIELD_COUNT (6) // Definition of the number of weather fields that are tracked (temperature, minimum, maximum, 'feels like', pressure and humidity).
+
+/// This is the 'weather_delta_tracker' class. It is used when the same locations are polled over and over again, and only the changes are of interest.
+/// For every location, a compact fingerprint of the last emitted values is kept in a state file. A field is only emitted when it changed more than a threshold, and when the JSON object did not change at all, it is not even parsed.
+/// Several runs (for different locations) can share the same state file. It is locked with a separate '<state_path>.lock' file while it is read and written, and it is replaced as a whole, so a crash never leaves a truncated state file behind.
+class weather_delta_tracker {
+public:
+    /// The constructor of the 'weather_delta_tracker' class. It constructs the whole object. The fingerprints of the previous polls are loaded when the JSON object is printed, while the state file is locked.
+    /// \param client_info The object that represents the info of your client. It also contains the flags/options parsed by the option parser.
+    /// \param state_path The path of the file in which the fingerprints of all locations are stored between two polls.
+    /// \param threshold A field is only emitted when it changed more than this threshold, compared with the last emitted value.
+    weather_delta_tracker(weather_client_info client_info, std::string state_path, double threshold);
+
+    /// This method converts the JSON format, and displays only the fields that changed since the last emitted values. Afterwards, the number of emitted and suppressed fields is reported.
+    /// \param json_message The JSON object that contains all the weather information (obtained from the 'openweathermap' web server).
+    void print_changed_json(const std::string& json_message);
+
+private:
+    /// The fingerprint of a single location. It only contains what is needed to detect a change.
+    struct location_fingerprint {
+        std::uint64_t body_hash; // The hash of the last JSON object that was parsed for this location.
+        unsigned int field_mask; // The bits of the fields that were requested when the last JSON object was parsed (bit 'i' is value 'i').
+        double threshold; // The threshold used when the last JSON object was parsed.
+        std::array<double, DELTA_FIELD_COUNT> values; // The last emitted value of every field, 'NaN' if it was never emitted.
+        std::uint64_t emitted_count; // The total number of fields emitted for this location.
+        std::uint64_t suppressed_count; // The total number of fields suppressed for this location.
+    };
+
+    /// This method compares the JSON object with the fingerprint of this location, and displays only the fields that changed. The state file must be locked while this method is called.
+    /// \param json_message The JSON object that contains all the weather information (obtained from the 'openweathermap' web server).
+    void print_changed_fields(const std::string& json_message);
+
+    /// This method loads the fingerprints of all locations from the state file. A missing state file simply means that there were no polls yet.
+    void load_state();
+
+    /// This method writes the fingerprints of all locations to a temporary file, and then renames it over the state file. So the state file is always complete.
+    void save_state() const;
+
+    weather_client_info m_client_data; // This field contains the data of your client.
+
+    std::string m_state_path; // The path of the state file.
+    double m_threshold; // The threshold a field has to change more than, before it is emitted.
+
+    std::map<std::string, location_fingerprint> m_fingerprints; // The fingerprints of all locations, the key is '<country_code>,<city_name>'.
+};
+
+#endif
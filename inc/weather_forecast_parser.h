@@ -0,0 +1,98 @@
+#ifndef WEATHER_APP_WEATHER_FORECAST_PARSER_H
+#define WEATHER_APP_WEATHER_FORECAST_PARSER_H
+
+#include <cstdint> // Include the 'standard' facilities, in this case 'cstdint'.
+#include <string> // Include the 'standard' facilities, in this case 'string'.
+#include <string_view> // Include the 'standard' facilities, in this case 'string_view'.
+#include <vector> // Include the 'standard' facilities, in this case 'vector'.
+
+#include "weather_client_info.h" // Include the 'weather_client_info' facilities.
+
+#define FORECAST_ENTRIES_DEFAULT (40) // Definition of the number of entries of the 5-day/3-hour forecast, used when the server does not tell the count up front.
+#define FORECAST_ENTRIES_MAX (FORECAST_ENTRIES_DEFAULT * 4) // Definition of the maximum number of entries that is preallocated, whatever count the server tells.
+
+#define FORECAST_FIELD_TIME (1 << 0) // Definition of the bit that is set when the time of a forecast entry has been read.
+#define FORECAST_FIELD_TEMPERATURE (1 << 1) // Definition of the bit that is set when the temperature of a forecast entry has been read.
+#define FORECAST_FIELD_PRESSURE (1 << 2) // Definition of the bit that is set when the pressure of a forecast entry has been read.
+#define FORECAST_FIELD_HUMIDITY (1 << 3) // Definition of the bit that is set when the humidity of a forecast entry has been read.
+#define FORECAST_FIELDS_ALL (FORECAST_FIELD_TIME | FORECAST_FIELD_TEMPERATURE | FORECAST_FIELD_PRESSURE | FORECAST_FIELD_HUMIDITY) // Definition of all bits, every forecast entry must contain all these fields.
+
+/// This is the 'weather_forecast_parser' class. It parses the JSON body of the 5-day/3-hour forecast incrementally, chunk by chunk, while it arrives from the socket.
+/// The whole body is never buffered. Every entry of the forecast goes straight into preallocated columns (time, temperature, pressure, humidity), so the memory stays proportional to the output.
+class weather_forecast_parser {
+public:
+    /// The constructor of the 'weather_forecast_parser' class. It constructs the whole object.
+    /// \param client_info The object that represents the info of your client. It also contains the flags/options parsed by the option parser.
+    explicit weather_forecast_parser(weather_client_info client_info);
+
+    /// This method feeds the next chunk of the JSON body to the parser. A chunk may end anywhere, even in the middle of a number or a string.
+    /// \param json_chunk The next part of the JSON body, as it is retrieved from the 'openweathermap' web server.
+    void feed(std::string_view json_chunk);
+
+    /// This method tells the parser that the whole JSON body has been fed. It throws when the JSON body was not complete, or when it did not contain any forecast entry.
+    /// Note that every forecast entry is checked while it is fed: an entry without 'dt' or one of the 'main' fields, or with a value that is not a number, makes 'feed' throw.
+    void finish();
+
+    /// This method displays the parsed forecast in the standard output. What is displayed is indicated by means of arguments that can be passed to the program.
+    void print_required_forecast() const;
+
+    /// This method returns the time of every forecast entry, in seconds since the UNIX epoch (the 'dt' field).
+    /// \return A constant reference to the column with all times.
+    [[nodiscard]] const std::vector<std::int64_t>& get_times() const;
+
+    /// This method returns the temperature of every forecast entry, in degrees Kelvin (the 'main.temp' field).
+    /// \return A constant reference to the column with all temperatures.
+    [[nodiscard]] const std::vector<double>& get_temperatures() const;
+
+    /// This method returns the pressure of every forecast entry, in hPa (the 'main.pressure' field).
+    /// \return A constant reference to the column with all pressures.
+    [[nodiscard]] const std::vector<double>& get_pressures() const;
+
+    /// This method returns the humidity of every forecast entry, in percent (the 'main.humidity' field).
+    /// \return A constant reference to the column with all humidity levels.
+    [[nodiscard]] const std::vector<double>& get_humidities() const;
+
+private:
+    /// The states of the scanner. A chunk can end in every state, the scanner simply continues with the next chunk.
+    enum class scanner_state { value, string, string_escape, number, literal };
+
+    /// A frame for every object or array the scanner is currently in. For objects, the last key that was read is saved as well.
+    struct scanner_frame {
+        bool is_object; // Is this frame an object (or an array)?
+        std::string key; // The last key read within this object.
+    };
+
+    /// This method handles a single character that is not part of a string, number or literal.
+    /// \param character The character to handle.
+    void handle_structural(char character);
+
+    /// This method is called for every complete number. It stores the number in the right column, when the number is one of the forecast fields.
+    void handle_number();
+
+    /// This method converts the current number to a value of the current forecast entry. It throws when the number can not be converted completely.
+    /// \param column_value The value in the column of the current forecast entry.
+    /// \param field_bit The bit of the field, it is set when the value has been read.
+    template <typename value_type>
+    void parse_entry_value(value_type& column_value, std::uint8_t field_bit);
+
+    /// This method checks if the scanner is directly inside an entry of the forecast 'list' array.
+    /// \return True if the scanner is inside a forecast entry.
+    [[nodiscard]] bool inside_forecast_entry() const;
+
+    weather_client_info m_client_data; // This field contains the data of your client.
+
+    std::vector<std::int64_t> m_times; // The column with the time of every forecast entry.
+    std::vector<double> m_temperatures; // The column with the temperature of every forecast entry.
+    std::vector<double> m_pressures; // The column with the pressure of every forecast entry.
+    std::vector<double> m_humidities; // The column with the humidity of every forecast entry.
+
+    std::vector<scanner_frame> m_frames; // The objects and arrays the scanner is currently in.
+    std::string m_token; // The key or number that is currently read. This is the only text that is kept between two chunks.
+    scanner_state m_state; // The current state of the scanner.
+    bool m_expect_key; // Is the next string a key (or a value)?
+    bool m_key_token; // Is the string that is currently read a key?
+    bool m_root_closed; // Is the root object of the JSON body closed?
+    std::uint8_t m_entry_fields; // The bits of the fields that have been read for the current forecast entry.
+};
+
+#endif
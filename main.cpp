@@ -4,6 +4,8 @@
 #include "weather_client_info.h" // Include the 'weather_client_info' facilities.
 #include "weather_data_json.h" // Include the 'weather_data_json' facilities.
 #include "weather_json_parser.h" // Include the 'weather_json_parser' facilities.
+#include "weather_forecast_parser.h" // Include the 'weather_forecast_parser' facilities.
+#include "weather_delta_tracker.h" // Include the 'weather_delta_tracker' facilities.
 
 // The main-function, here 'argc' and 'argv' are used for the program arguments passed to the program.
 int main(int argc, char* argv[]) {
@@ -17,6 +19,10 @@ int main(int argc, char* argv[]) {
     parser.add_flag_option("feels_like,f", "prints shows the temperature as it feels to humans"); // Option to print the 'feels like' temperature.
     parser.add_flag_option("pressure,p", "prints the barometric pressure level"); // Option to print the pressure in 'hPa'.
     parser.add_flag_option("humidity,v", "prints the humidity level"); // Option to print the percentage of the humidity.
+    parser.add_flag_option("forecast,c", "prints the 5-day/3-hour forecast (temperature, pressure and humidity)"); // Option to print the forecast instead of the current weather.
+    parser.add_flag_option("delta,d", "prints only the fields that changed since the previous poll of this location"); // Option to only print the changes, used when polling repeatedly.
+    parser.add_dbl_option("delta_threshold", "a field is only printed when it changed more than this threshold", 0.5); // The threshold used by the 'delta' option.
+    parser.add_string_option("delta_state", "file in which the last printed values of every location are stored", "weather_delta_state.txt"); // The state file used by the 'delta' option.
     parser.add_string_positional("country_code", "name of the country where you want to display the weather for"); // A positional argument for the country. This argument must be present within the program arguments.
     parser.add_string_positional("city_name", "name of the city where you want to display the weather for"); // A positional argument for the city name. This argument must be present within the program arguments.
 
@@ -34,8 +40,38 @@ int main(int argc, char* argv[]) {
         parsed_object.count("city_name") ? parsed_object["city_name"].as<std::string>() : "" // Your city name, as you see, we are using a simple string for representing the city name.
     };
 
+    // The forecast is much larger than the current weather, so its body is parsed chunk by chunk while it arrives from the socket.
+    if (parsed_object.count("forecast") != 0) {
+        // The forecast only contains the temperature, pressure and humidity. It is also not tracked by the 'delta' option. So reject the options that would be ignored.
+        for (const auto* unsupported_option : {"min_temperature", "max_temperature", "feels_like", "delta"}) {
+            if (parsed_object.count(unsupported_option) != 0) {
+                std::cerr << "ERROR MESSAGE - OPTION '" << unsupported_option << "' CAN NOT BE COMBINED WITH 'forecast'!" << std::endl; // Show a standard error message.
+                return 1;
+            }
+        }
+
+        weather_data_json forecast_object{data, "api.openweathermap.org", "/data/2.5/forecast?q=", "19733fe7cf4a691b3fba8b1a8cffb44b"}; // Create an instance for streaming the forecast.
+
+        weather_forecast_parser forecast_parser{data}; // The parser that stores all forecast entries.
+
+        // Print the requested forecast data, only if the whole forecast has been retrieved.
+        if (forecast_object.stream_weather_forecast(forecast_parser))
+            forecast_parser.print_required_forecast();
+
+        return 0;
+    }
+
     weather_data_json json_object{data, "api.openweathermap.org", "/data/2.5/weather?q=", "19733fe7cf4a691b3fba8b1a8cffb44b"}; // Create an instance for retrieving th JSON data.
 
+    // Only print the changes since the previous poll of this location. The last printed values are kept in the state file.
+    if (parsed_object.count("delta") != 0) {
+        weather_delta_tracker delta_tracker{data, parsed_object["delta_state"].as<std::string>(), parsed_object["delta_threshold"].as<double>()}; // Create the tracker, it loads the state of the previous polls.
+
+        delta_tracker.print_changed_json(json_object.retrieve_weather_json()); // Print only the changed data by calling this method on 'delta_tracker'.
+
+        return 0;
+    }
+
     weather_json_parser json_parser{data}; // Parse the given data.
 
     json_parser.print_required_json(json_object.retrieve_weather_json()); // Print the requested data by calling this method on 'json_parser'.
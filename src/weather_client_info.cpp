@@ -63,4 +63,20 @@ std::string weather_client_info::generate_http_weather_request(const std::string
     string_stream << "Connection: close\n\n";
 
     return string_stream.str(); // Convert the stream of all the HTTPS request into a string.
+}
+
+// This method generates the header that shows for which location the weather is displayed, e.g. 'WEATHER FOR: NL, Enschede'.
+std::string weather_client_info::generate_location_header(const std::string &header_title) const {
+    auto country_code = boost::any_cast<std::string>(m_country_code); // Retrieve the country code.
+    auto city_name = boost::any_cast<std::string>(m_city_name); // Retrieve the city name.
+
+    std::stringstream string_stream{}; // Use a 'string stream'.
+
+    // Show where the weather is displayed for:
+    string_stream << header_title << " FOR: "
+        << (!country_code.empty() ? country_code : "NO COUNTRY CODE PROVIDED") // Check if the country code is not an empty string. If it is an empty string, no country code was provided within the arguments passed to your program.
+        << ", "
+        << (!city_name.empty() ? city_name : "NO CITY NAME PROVIDED"); // Check if the city name is not an empty string. If it is an empty string, no city name was provided within the arguments passed to your program.
+
+    return string_stream.str(); // Convert the stream of the header into a string.
 }
\ No newline at end of file
@@ -19,14 +19,7 @@ std::string weather_data_json::retrieve_weather_json() const {
         boost::asio::ssl::context ssl_context_data(boost::asio::ssl::context::tls); // The context data used for SSL. Its type is TLS (Transport Layer Security).
         boost::asio::ssl::stream<boost::asio::ip::tcp::socket> socket_application(io_context_data, ssl_context_data); // Create a socket, whereby the underlying layer TCP is. This internet protocol ensures that all sent packets arrive at the server. It is a connection oriented socket.
 
-        boost::asio::ip::tcp::resolver resolver_ip_address(io_context_data); // Variable to find the IP address of your host.
-        auto endpoint_of_server = resolver_ip_address.resolve(m_host_name_weather_app, std::to_string(PORT_VALUE_HTTPS)); // Try to find the IP-address. Use port '433', used for HTTPS request. Defined by RFC.
-
-        boost::asio::connect(socket_application.next_layer(), endpoint_of_server); // Connect with the server.
-
-        socket_application.handshake(boost::asio::ssl::stream_base::client); // Apply a handshake.
-
-        boost::asio::write(socket_application, boost::asio::buffer(m_client_data.generate_http_weather_request(m_host_name_weather_app, m_host_url, m_api_key_weather_app))); // Send your whole request to the server.
+        send_weather_request(socket_application); // Connect with the server, and send your whole request to it.
 
         boost::asio::streambuf response; // Stream buffer for the response.
         boost::system::error_code error_code; // Variable for the 'error code'.
@@ -45,4 +38,64 @@ std::string weather_data_json::retrieve_weather_json() const {
     }
 
     return response_message; // Return the body of the response, this is encoded in JSON format. Empty string if retrieving the weather data failed.
+}
+
+// This method contacts the webserver just like 'retrieve_weather_json', but it never buffers the whole body. Every chunk of the body is directly fed to the forecast parser when it arrives from the socket.
+bool weather_data_json::stream_weather_forecast(weather_forecast_parser &forecast_parser) const {
+    // A try/catch block to catch exceptions that can occur.
+    try {
+        boost::asio::io_context io_context_data; // The context data for the I/O.
+        boost::asio::ssl::context ssl_context_data(boost::asio::ssl::context::tls); // The context data used for SSL. Its type is TLS (Transport Layer Security).
+        boost::asio::ssl::stream<boost::asio::ip::tcp::socket> socket_application(io_context_data, ssl_context_data); // Create a socket, whereby the underlying layer TCP is. This internet protocol ensures that all sent packets arrive at the server. It is a connection oriented socket.
+
+        send_weather_request(socket_application); // Connect with the server, and send your whole request to it.
+
+        // Only read the header first. The 'buffer_body' does not store the body, it writes into the chunk that is given to it.
+        boost::beast::flat_buffer response_buffer;
+        boost::beast::http::response_parser<boost::beast::http::buffer_body> response_parser;
+        boost::beast::http::read_header(socket_application, response_buffer, response_parser);
+
+        // An error reply of the server (for example '401' or '404') is a valid JSON object as well, so check the status before the body is parsed.
+        if (response_parser.get().result() != boost::beast::http::status::ok)
+            throw std::runtime_error{"forecast request not accepted by the server"};
+
+        char body_chunk[FORECAST_CHUNK_SIZE]; // The chunk in which every part of the body is read.
+
+        // Read the body chunk by chunk, and feed every chunk directly to the forecast parser.
+        while (!response_parser.is_done()) {
+            response_parser.get().body().data = body_chunk;
+            response_parser.get().body().size = sizeof(body_chunk);
+
+            boost::system::error_code error_code; // Variable for the 'error code'.
+            boost::beast::http::read(socket_application, response_buffer, response_parser, error_code);
+
+            // A full chunk is reported as 'need_buffer', that is not an error.
+            if (error_code && error_code != boost::beast::http::error::need_buffer)
+                throw boost::system::system_error{error_code};
+
+            forecast_parser.feed({body_chunk, sizeof(body_chunk) - response_parser.get().body().size});
+        }
+
+        forecast_parser.finish(); // The whole body is fed, so check if the JSON body was complete.
+    }
+    // Used for catching exceptions, in this case all exceptions that can occur.
+    catch (const std::exception&) {
+        std::cerr << "ERROR MESSAGE - STREAMING THE FORECAST FROM THE INTERNET SERVICE NOT SUCCEEDED!" << std::endl; // Show a standard error message.
+        return false;
+    }
+
+    return true; // The whole forecast is retrieved and parsed.
+}
+
+
+// This method connects with the webserver, applies the handshake, and sends the HTTPS request to it. The response can then be read from the given socket.
+void weather_data_json::send_weather_request(boost::asio::ssl::stream<boost::asio::ip::tcp::socket> &socket_application) const {
+    boost::asio::ip::tcp::resolver resolver_ip_address(socket_application.get_executor()); // Variable to find the IP address of your host.
+    auto endpoint_of_server = resolver_ip_address.resolve(m_host_name_weather_app, std::to_string(PORT_VALUE_HTTPS)); // Try to find the IP-address. Use port '433', used for HTTPS request. Defined by RFC.
+
+    boost::asio::connect(socket_application.next_layer(), endpoint_of_server); // Connect with the server.
+
+    socket_application.handshake(boost::asio::ssl::stream_base::client); // Apply a handshake.
+
+    boost::asio::write(socket_application, boost::asio::buffer(m_client_data.generate_http_weather_request(m_host_name_weather_app, m_host_url, m_api_key_weather_app))); // Send your whole request to the server.
 }
\ No newline at end of file
@@ -0,0 +1,216 @@
+#include "weather_delta_tracker.h"
+
+#include <boost/interprocess/sync/file_lock.hpp> // Include the 'Boost' facilities, in this case 'interprocess - file_lock.hpp'.
+#include <boost/interprocess/sync/scoped_lock.hpp> // Include the 'Boost' facilities, in this case 'interprocess - scoped_lock.hpp'.
+
+#include <cmath> // Include the 'standard' facilities, in this case 'cmath'.
+#include <cstdio> // Include the 'standard' facilities, in this case 'cstdio'.
+#include <cstdlib> // Include the 'standard' facilities, in this case 'cstdlib'.
+#include <fstream> // Include the 'standard' facilities, in this case 'fstream'.
+#include <limits> // Include the 'standard' facilities, in this case 'limits'.
+
+#include "weather_json_parser.h" // Include the 'weather_json_parser' facilities, used for the 'property_tree' and 'TEMP_DEGREES_DECR'.
+
+// This function calculates the hash of the whole JSON object. The 'FNV-1a' hash is used, because it stays the same between two runs of the program (it is stored in the state file).
+static std::uint64_t hash_json_body(const std::string& json_message) {
+    std::uint64_t body_hash = 14695981039346656037ULL; // The 'FNV-1a' offset basis.
+
+    for (unsigned char character : json_message) {
+        body_hash ^= character;
+        body_hash *= 1099511628211ULL; // The 'FNV-1a' prime.
+    }
+
+    return body_hash;
+}
+
+// The constructor of the 'weather_delta_tracker' class. It constructs the whole object. The fingerprints of the previous polls are loaded when the JSON object is printed, while the state file is locked.
+weather_delta_tracker::weather_delta_tracker(weather_client_info client_info, std::string state_path, double threshold) :
+    // Where 'std::move(...)' is used, the ownership is moved. Where '{}' is used after a field, that is a default initialization.
+    m_client_data{std::move(client_info)},
+    m_state_path{std::move(state_path)},
+    m_threshold{threshold},
+    m_fingerprints{}
+{}
+
+// This method converts the JSON format, and displays only the fields that changed since the last emitted values. Afterwards, the number of emitted and suppressed fields is reported.
+void weather_delta_tracker::print_changed_json(const std::string &json_message) {
+    // A try/catch block to catch exceptions that can occur.
+    try {
+        auto lock_path = m_state_path + ".lock"; // The file used for locking the state file. A 'file_lock' can only be used on an existing file.
+        std::ofstream{lock_path, std::ios::app};
+
+        // Lock the state file from loading until saving, so parallel runs for other locations do not overwrite each other's fingerprints.
+        boost::interprocess::file_lock state_lock{lock_path.c_str()};
+        boost::interprocess::scoped_lock<boost::interprocess::file_lock> state_guard{state_lock};
+
+        load_state(); // Load the fingerprints of the previous polls.
+        print_changed_fields(json_message); // Display the changed fields, and store the fingerprints for the next poll.
+    }
+    // Used for catching exceptions, in this case 'interprocess' exceptions.
+    catch (const boost::interprocess::interprocess_exception&) {
+        std::cerr << "ERROR MESSAGE - LOCKING THE DELTA STATE NOT SUCCEEDED!" << std::endl; // Show a standard error message.
+    }
+}
+
+// This method compares the JSON object with the fingerprint of this location, and displays only the fields that changed. The state file must be locked while this method is called.
+void weather_delta_tracker::print_changed_fields(const std::string &json_message) {
+    // A single field that can be tracked. It refers to the option of the client, and also tells how the field must be shown.
+    struct delta_field {
+        const std::pair<boost::any, std::string>& exists; // The option of the client, along with the recognition in the JSON object.
+        const char* label; // The label shown in front of the value.
+        const char* unit; // The unit shown after the value.
+        bool is_temperature; // Must the value be converted from degrees Kelvin to degrees Celsius?
+    };
+
+    // All fields that can be tracked. The order is the same as the order of the values in the fingerprint.
+    const std::array<delta_field, DELTA_FIELD_COUNT> delta_fields{{
+        {m_client_data.get_exists_temperature(), "TEMPERATURE", " °C", true},
+        {m_client_data.get_exists_min_temperature(), "MINIMUM TEMPERATURE", " °C", true},
+        {m_client_data.get_exists_max_temperature(), "MAXIMUM TEMPERATURE", " °C", true},
+        {m_client_data.get_exists_feels_like(), "FEELS LIKE", " °C", true},
+        {m_client_data.get_exists_pressure(), "PRESSURE", " hPa", false},
+        {m_client_data.get_exists_humidity(), "HUMIDITY", "%", false}
+    }};
+
+    auto country_code = boost::any_cast<std::string>(m_client_data.get_country_code()); // Retrieve the country code.
+    auto city_name = boost::any_cast<std::string>(m_client_data.get_city_name()); // Retrieve the city name.
+
+    // Find the fingerprint of this location. If this location was never polled before, no value has been emitted yet.
+    location_fingerprint new_fingerprint{0, 0, 0, {}, 0, 0};
+    new_fingerprint.values.fill(std::numeric_limits<double>::quiet_NaN());
+    auto [fingerprint_iterator, first_poll] = m_fingerprints.try_emplace(country_code + "," + city_name, new_fingerprint);
+    location_fingerprint& fingerprint = fingerprint_iterator->second;
+
+    auto body_hash = hash_json_body(json_message); // The hash of the JSON object of this poll.
+
+    // The bits of the fields that are requested during this poll.
+    unsigned int field_mask{};
+    for (std::size_t index = 0; index < DELTA_FIELD_COUNT; ++index)
+        if (boost::any_cast<bool>(delta_fields[index].exists.first))
+            field_mask |= 1U << index;
+
+    std::uint64_t emitted_count{}; // The number of fields emitted during this poll.
+    std::uint64_t suppressed_count{}; // The number of fields suppressed during this poll.
+
+    // When the JSON object did not change, and the last parse used the same fields and threshold, nothing can have changed. So do not parse the JSON object at all.
+    // With other fields or another threshold, a field could have changed since it was last emitted (while it was not requested), so the JSON object must be parsed again.
+    if (!first_poll && fingerprint.body_hash == body_hash && fingerprint.field_mask == field_mask && fingerprint.threshold == m_threshold) {
+        for (const auto& field : delta_fields)
+            if (boost::any_cast<bool>(field.exists.first))
+                ++suppressed_count;
+    }
+    else {
+        // A try/catch block to catch exceptions that can occur.
+        try {
+            std::stringstream string_stream{json_message}; // This 'string stream' will be used by the JSON parser.
+
+            boost::property_tree::ptree prop_tree{}; // This data structure is used by the JSON parser, it is called a 'property_tree'.
+            boost::property_tree::read_json(string_stream, prop_tree); // Read the 'string stream', and parse it to JSON (individual objects within this specific JSON format).
+
+            // First read all requested values, so the fingerprint is not changed when one of the values is missing.
+            auto new_values = fingerprint.values;
+            for (std::size_t index = 0; index < DELTA_FIELD_COUNT; ++index)
+                if (boost::any_cast<bool>(delta_fields[index].exists.first))
+                    new_values[index] = prop_tree.get<double>("main." + delta_fields[index].exists.second) - (delta_fields[index].is_temperature ? TEMP_DEGREES_DECR : 0);
+
+            std::stringstream changed_stream{}; // All fields that changed more than the threshold.
+
+            // Only emit the fields that changed more than the threshold. The fingerprint keeps the last emitted value, so a slow drift is still emitted at some point.
+            for (std::size_t index = 0; index < DELTA_FIELD_COUNT; ++index) {
+                if (!boost::any_cast<bool>(delta_fields[index].exists.first))
+                    continue;
+
+                if (std::isnan(fingerprint.values[index]) || std::fabs(new_values[index] - fingerprint.values[index]) > m_threshold) {
+                    changed_stream << delta_fields[index].label << ": " << new_values[index] << delta_fields[index].unit << std::endl;
+                    fingerprint.values[index] = new_values[index];
+                    ++emitted_count;
+                }
+                else
+                    ++suppressed_count;
+            }
+
+            fingerprint.body_hash = body_hash;
+            fingerprint.field_mask = field_mask;
+            fingerprint.threshold = m_threshold;
+
+            // Only show the location when at least one field changed.
+            if (emitted_count != 0)
+                std::cout << m_client_data.generate_location_header("WEATHER") << std::endl << changed_stream.str();
+        }
+        // Used for catching exceptions, in this case all exceptions that can occur.
+        catch (const std::exception&) {
+            std::cerr << "ERROR MESSAGE - PARSING TO SPECIFIC OBJECTS NOT SUCCEEDED!" << std::endl; // Show a standard error message.
+
+            // Do not remember a location for which nothing could be parsed.
+            if (first_poll)
+                m_fingerprints.erase(fingerprint_iterator);
+            return;
+        }
+    }
+
+    fingerprint.emitted_count += emitted_count;
+    fingerprint.suppressed_count += suppressed_count;
+
+    save_state(); // Store the fingerprints for the next poll.
+
+    // Report the savings. This is written to the log, so the standard output only contains the changes.
+    std::clog << "DELTA: " << emitted_count << " EMITTED, " << suppressed_count << " SUPPRESSED"
+        << " (TOTAL: " << fingerprint.emitted_count << " EMITTED, " << fingerprint.suppressed_count << " SUPPRESSED)" << std::endl;
+}
+
+// This method loads the fingerprints of all locations from the state file. A missing state file simply means that there were no polls yet.
+void weather_delta_tracker::load_state() {
+    std::ifstream state_file{m_state_path};
+    std::string state_line{};
+
+    m_fingerprints.clear(); // Only the fingerprints in the state file are valid.
+
+    // Every line is a single location: '<hash> <field_mask> <threshold> <emitted> <suppressed> <value_1> ... <value_6> <location>'.
+    while (std::getline(state_file, state_line)) {
+        std::istringstream line_stream{state_line};
+        location_fingerprint fingerprint{};
+
+        line_stream >> fingerprint.body_hash >> fingerprint.field_mask >> fingerprint.threshold >> fingerprint.emitted_count >> fingerprint.suppressed_count;
+
+        // The values are read as text, because 'NaN' can not be read with the stream operator.
+        for (auto& value : fingerprint.values) {
+            std::string value_text{};
+            line_stream >> value_text;
+            value = std::strtod(value_text.c_str(), nullptr);
+        }
+
+        // The location is the rest of the line, because a city name can contain spaces.
+        std::string location{};
+        line_stream >> std::ws;
+        std::getline(line_stream, location);
+
+        // Skip lines that are not complete.
+        if (!line_stream.fail() && !location.empty())
+            m_fingerprints[location] = fingerprint;
+    }
+}
+
+// This method writes the fingerprints of all locations to a temporary file, and then renames it over the state file. So the state file is always complete.
+void weather_delta_tracker::save_state() const {
+    auto temporary_path = m_state_path + ".tmp"; // The temporary file is in the same directory, so renaming it replaces the state file at once.
+    std::ofstream state_file{temporary_path, std::ios::trunc};
+    state_file.precision(std::numeric_limits<double>::max_digits10); // Write the values without losing precision.
+
+    // Every line is a single location: '<hash> <field_mask> <threshold> <emitted> <suppressed> <value_1> ... <value_6> <location>'.
+    for (const auto& [location, fingerprint] : m_fingerprints) {
+        state_file << fingerprint.body_hash << ' ' << fingerprint.field_mask << ' ' << fingerprint.threshold << ' ' << fingerprint.emitted_count << ' ' << fingerprint.suppressed_count;
+
+        for (double value : fingerprint.values)
+            state_file << ' ' << value;
+
+        state_file << ' ' << location << '\n';
+    }
+
+    state_file.close(); // Flush all fingerprints, before the file is renamed.
+
+    // Check if all fingerprints are written, and replace the state file with them. Otherwise, the previous state file is kept.
+    if (state_file.fail() || std::rename(temporary_path.c_str(), m_state_path.c_str()) != 0) {
+        std::cerr << "ERROR MESSAGE - WRITING THE DELTA STATE NOT SUCCEEDED!" << std::endl; // Show a standard error message.
+        std::remove(temporary_path.c_str());
+    }
+}
@@ -0,0 +1,270 @@
+#include "weather_forecast_parser.h"
+
+#include <algorithm> // Include the 'standard' facilities, in this case 'algorithm'.
+#include <charconv> // Include the 'standard' facilities, in this case 'charconv'.
+#include <ctime> // Include the 'standard' facilities, in this case 'ctime'.
+#include <iomanip> // Include the 'standard' facilities, in this case 'iomanip'.
+#include <iostream> // Include the 'standard' facilities, in this case 'iostream'.
+#include <limits> // Include the 'standard' facilities, in this case 'limits'.
+#include <stdexcept> // Include the 'standard' facilities, in this case 'stdexcept'.
+
+#include "weather_json_parser.h" // Include the 'weather_json_parser' facilities, used for 'TEMP_DEGREES_DECR'.
+
+// The constructor of the 'weather_forecast_parser' class. It constructs the whole object.
+weather_forecast_parser::weather_forecast_parser(weather_client_info client_info) :
+    // Where 'std::move(...)' is used, the ownership is moved. Where '{}' is used after a field, that is a default initialization.
+    m_client_data{std::move(client_info)},
+    m_times{},
+    m_temperatures{},
+    m_pressures{},
+    m_humidities{},
+    m_frames{},
+    m_token{},
+    m_state{scanner_state::value},
+    m_expect_key{false},
+    m_key_token{false},
+    m_root_closed{false},
+    m_entry_fields{0}
+{
+    // Preallocate all columns, so no reallocation is needed while the entries arrive.
+    m_times.reserve(FORECAST_ENTRIES_DEFAULT);
+    m_temperatures.reserve(FORECAST_ENTRIES_DEFAULT);
+    m_pressures.reserve(FORECAST_ENTRIES_DEFAULT);
+    m_humidities.reserve(FORECAST_ENTRIES_DEFAULT);
+}
+
+// This method feeds the next chunk of the JSON body to the parser. A chunk may end anywhere, even in the middle of a number or a string.
+void weather_forecast_parser::feed(std::string_view json_chunk) {
+    for (char character : json_chunk) {
+        switch (m_state) {
+            case scanner_state::string:
+                // The end of the string. Only keys are saved, all string values are skipped.
+                if (character == '"') {
+                    if (m_key_token)
+                        m_frames.back().key = m_token;
+                    m_state = scanner_state::value;
+                }
+                else if (character == '\\')
+                    m_state = scanner_state::string_escape;
+                else if (m_key_token)
+                    m_token.push_back(character);
+                break;
+
+            case scanner_state::string_escape:
+                // The escaped character is taken literally, none of the keys we are looking for contain an escape.
+                if (m_key_token)
+                    m_token.push_back(character);
+                m_state = scanner_state::string;
+                break;
+
+            case scanner_state::number:
+                // Keep reading the number, until a character is found that can not be part of it.
+                if ((character >= '0' && character <= '9') || character == '.' || character == '-' || character == '+' || character == 'e' || character == 'E') {
+                    m_token.push_back(character);
+                    break;
+                }
+                handle_number();
+                m_state = scanner_state::value;
+                handle_structural(character);
+                break;
+
+            case scanner_state::literal:
+                // Keep reading the literal ('true', 'false' or 'null'), until a character is found that can not be part of it.
+                if (character >= 'a' && character <= 'z') {
+                    m_token.push_back(character);
+                    break;
+                }
+                if (m_token != "true" && m_token != "false" && m_token != "null")
+                    throw std::runtime_error{"invalid literal in forecast JSON"};
+                m_state = scanner_state::value;
+                handle_structural(character);
+                break;
+
+            case scanner_state::value:
+                handle_structural(character);
+                break;
+        }
+    }
+}
+
+// This method tells the parser that the whole JSON body has been fed. It throws when the JSON body was not complete.
+void weather_forecast_parser::finish() {
+    if (m_state != scanner_state::value || !m_frames.empty() || !m_root_closed)
+        throw std::runtime_error{"incomplete forecast JSON"};
+
+    // A forecast without any entry is not a forecast, the server most likely replied with an error object.
+    if (m_times.empty())
+        throw std::runtime_error{"forecast JSON without entries"};
+}
+
+// This method handles a single character that is not part of a string, number or literal.
+void weather_forecast_parser::handle_structural(char character) {
+    // Whitespace between the tokens is skipped.
+    if (character == ' ' || character == '\n' || character == '\r' || character == '\t')
+        return;
+
+    // Nothing may follow after the root object has been closed.
+    if (m_root_closed)
+        throw std::runtime_error{"unexpected data after forecast JSON"};
+
+    switch (character) {
+        case '"':
+            m_key_token = m_expect_key;
+            m_expect_key = false;
+            m_token.clear();
+            m_state = scanner_state::string;
+            break;
+
+        case '{':
+            // A new object directly inside the 'list' array is a new forecast entry. Append it to every column, the values are filled in while the entry is read.
+            if (m_frames.size() == 2 && m_frames[0].is_object && m_frames[0].key == "list" && !m_frames[1].is_object) {
+                m_times.push_back(0);
+                m_temperatures.push_back(std::numeric_limits<double>::quiet_NaN());
+                m_pressures.push_back(std::numeric_limits<double>::quiet_NaN());
+                m_humidities.push_back(std::numeric_limits<double>::quiet_NaN());
+                m_entry_fields = 0;
+            }
+            m_frames.push_back({true, {}});
+            m_expect_key = true;
+            break;
+
+        case '[':
+            m_frames.push_back({false, {}});
+            m_expect_key = false;
+            break;
+
+        case '}':
+        case ']':
+            // Check if the closing character matches the object or array that was opened.
+            if (m_frames.empty() || m_frames.back().is_object != (character == '}'))
+                throw std::runtime_error{"unbalanced forecast JSON"};
+            // A forecast entry is closed, so every field of it must have been read. Otherwise, the columns would contain made up values.
+            if (m_frames.size() == 3 && inside_forecast_entry() && m_entry_fields != FORECAST_FIELDS_ALL)
+                throw std::runtime_error{"incomplete forecast entry"};
+            m_frames.pop_back();
+            m_expect_key = false;
+            m_root_closed = m_frames.empty();
+            break;
+
+        case ':':
+            m_expect_key = false;
+            break;
+
+        case ',':
+            m_expect_key = !m_frames.empty() && m_frames.back().is_object;
+            break;
+
+        default:
+            if (character == '-' || (character >= '0' && character <= '9'))
+                m_state = scanner_state::number;
+            else if (character == 't' || character == 'f' || character == 'n')
+                m_state = scanner_state::literal;
+            else
+                throw std::runtime_error{"unexpected character in forecast JSON"};
+            m_token.assign(1, character);
+            break;
+    }
+}
+
+// This method is called for every complete number. It stores the number in the right column, when the number is one of the forecast fields.
+void weather_forecast_parser::handle_number() {
+    const char* first = m_token.data();
+    const char* last = m_token.data() + m_token.size();
+
+    // The 'cnt' field tells how many entries follow, so the columns can be preallocated to the exact size. The count comes from the server, so it is capped to a sane maximum.
+    if (m_frames.size() == 1 && m_frames[0].key == "cnt") {
+        std::size_t count{};
+        if (std::from_chars(first, last, count).ec == std::errc{}) {
+            count = std::min<std::size_t>(count, FORECAST_ENTRIES_MAX);
+            m_times.reserve(count);
+            m_temperatures.reserve(count);
+            m_pressures.reserve(count);
+            m_humidities.reserve(count);
+        }
+        return;
+    }
+
+    if (!inside_forecast_entry())
+        return;
+
+    // The time of the forecast entry, which is 'list[i].dt'.
+    if (m_frames.size() == 3 && m_frames[2].key == "dt") {
+        parse_entry_value(m_times.back(), FORECAST_FIELD_TIME);
+        return;
+    }
+
+    // The weather values of the forecast entry, which are 'list[i].main.*'.
+    if (m_frames.size() == 4 && m_frames[2].key == "main" && m_frames[3].is_object) {
+        const std::string& key = m_frames[3].key;
+
+        if (key == "temp")
+            parse_entry_value(m_temperatures.back(), FORECAST_FIELD_TEMPERATURE);
+        else if (key == "pressure")
+            parse_entry_value(m_pressures.back(), FORECAST_FIELD_PRESSURE);
+        else if (key == "humidity")
+            parse_entry_value(m_humidities.back(), FORECAST_FIELD_HUMIDITY);
+    }
+}
+
+// This method converts the current number to a value of the current forecast entry. It throws when the number can not be converted completely.
+template <typename value_type>
+void weather_forecast_parser::parse_entry_value(value_type& column_value, std::uint8_t field_bit) {
+    const char* last = m_token.data() + m_token.size();
+    auto [end_of_number, error_code] = std::from_chars(m_token.data(), last, column_value);
+
+    if (error_code != std::errc{} || end_of_number != last)
+        throw std::runtime_error{"invalid number in forecast entry"};
+
+    m_entry_fields |= field_bit; // This field of the entry has been read.
+}
+
+// This method checks if the scanner is directly inside an entry of the forecast 'list' array.
+bool weather_forecast_parser::inside_forecast_entry() const {
+    return m_frames.size() >= 3 && m_frames[0].is_object && m_frames[0].key == "list" && !m_frames[1].is_object && m_frames[2].is_object;
+}
+
+// This method displays the parsed forecast in the standard output. What is displayed is indicated by means of arguments that can be passed to the program.
+void weather_forecast_parser::print_required_forecast() const {
+    std::cout << m_client_data.generate_location_header("FORECAST") << std::endl; // Show where the forecast is displayed for.
+
+    auto show_temperature = boost::any_cast<bool>(m_client_data.get_exists_temperature().first); // Check if the temperature flag passed to the program.
+    auto show_pressure = boost::any_cast<bool>(m_client_data.get_exists_pressure().first); // Check if the pressure flag passed to the program.
+    auto show_humidity = boost::any_cast<bool>(m_client_data.get_exists_humidity().first); // Check if the humidity flag passed to the program.
+
+    // Print one line for every forecast entry, with the time in UTC.
+    for (std::size_t index = 0; index < m_times.size(); ++index) {
+        std::time_t entry_time = static_cast<std::time_t>(m_times[index]);
+        std::cout << std::put_time(std::gmtime(&entry_time), "%Y-%m-%d %H:%M");
+
+        if (show_temperature)
+            std::cout << " | TEMPERATURE: " << (m_temperatures[index] - TEMP_DEGREES_DECR) << " °C";
+
+        if (show_pressure)
+            std::cout << " | PRESSURE: " << m_pressures[index] << " hPa";
+
+        if (show_humidity)
+            std::cout << " | HUMIDITY: " << m_humidities[index] << "%";
+
+        std::cout << std::endl;
+    }
+}
+
+// This method returns the time of every forecast entry, in seconds since the UNIX epoch (the 'dt' field).
+const std::vector<std::int64_t> &weather_forecast_parser::get_times() const {
+    return m_times;
+}
+
+// This method returns the temperature of every forecast entry, in degrees Kelvin (the 'main.temp' field).
+const std::vector<double> &weather_forecast_parser::get_temperatures() const {
+    return m_temperatures;
+}
+
+// This method returns the pressure of every forecast entry, in hPa (the 'main.pressure' field).
+const std::vector<double> &weather_forecast_parser::get_pressures() const {
+    return m_pressures;
+}
+
+// This method returns the humidity of every forecast entry, in percent (the 'main.humidity' field).
+const std::vector<double> &weather_forecast_parser::get_humidities() const {
+    return m_humidities;
+}
@@ -15,15 +15,7 @@ void weather_json_parser::print_required_json(const std::string &json_message) c
         boost::property_tree::ptree prop_tree{}; // This data structure is used by the JSON parser, it is called a 'property_tree'.
         boost::property_tree::read_json(string_stream, prop_tree); // Read the 'string stream', and parse it to JSON (individual objects within this specific JSON format).
 
-        auto country_code = boost::any_cast<std::string>(m_client_data.get_country_code()); // Retrieve the country code.
-        auto city_name = boost::any_cast<std::string>(m_client_data.get_city_name()); // Retrieve the city name.
-
-        // Show where the weather is displayed for:
-        std::cout << "WEATHER FOR: "
-            << (!country_code.empty() ? country_code : "NO COUNTRY CODE PROVIDED") // Check if the country code is not an empty string. If it is an empty string, no country code was provided within the arguments passed to your program.
-            << ", "
-            << (!city_name.empty() ? city_name : "NO CITY NAME PROVIDED") // Check if the city name is not an empty string. If it is an empty string, no city name was provided within the arguments passed to your program.
-            << std::endl;
+        std::cout << m_client_data.generate_location_header("WEATHER") << std::endl; // Show where the weather is displayed for.
 
         // Check if the temperature flag passed to the program. If so, print the temperature.
         if (boost::any_cast<bool>(m_client_data.get_exists_temperature().first))